@@ -20,6 +20,8 @@
 #include <tremor/ivorbisfile.h>
 #include <tremor/ivorbiscodec.h>
 
+#include "audioOGG.h"
+
 
 //   ╔════════════════════════════════════════════════╗
 // ══╣                  DEFINITIONS                   ╠══
@@ -28,6 +30,7 @@
 #define MAX_STREAMS 8 /** @brief Maximum number of audio streams that can be played simultaneously */
 #define THREAD_STACK_SZ (32 * 1024) /** @brief Stack size for audio threads */
 #define THREAD_AFFINITY -1 /** @brief Thread affinity for audio threads */
+#define NDSP_FRAME_SAMPLES 160 /** @brief Number of output samples NDSP processes per audio frame */
 
 
 //   ╔════════════════════════════════════════════════╗
@@ -38,13 +41,30 @@ typedef struct {
     bool active; /** @brief Flag indicating if the audio stream is active */
     bool loop; /** @brief Flag indicating if the audio stream should loop */
     bool quit; /** @brief Flag indicating if the audio stream should quit */
+    bool decodeDone; /** @brief Flag indicating if the whole file has been decoded (non-looping streams only) */
+    bool scheduled; /** @brief Flag indicating if the audio stream is ready and waiting for its start time */
+    bool started; /** @brief Flag indicating if the audio stream's buffers have been handed to NDSP */
+    bool firstQueued; /** @brief Flag indicating if the stream's first wave buffer has been handed to NDSP */
+    bool startObserved; /** @brief Flag indicating if NDSP has reported the stream's first sample playing */
     int channel; /** @brief Audio channel for the stream */
+    int channels; /** @brief Number of audio channels in the stream (1 for mono, 2 for stereo) */
+    int rate; /** @brief Sample rate of the stream */
 
     OggVorbis_File vorbisFile; /** @brief Vorbis file handle */
     FILE *fileHandle; /** @brief File handle for the audio stream */
 
     ndspWaveBuf waveBufs[3]; /** @brief NDSP wave buffers for the audio stream */
     int16_t *audioBuffer; /** @brief Pointer to the audio buffer for the stream */
+    size_t samplesPerBuf; /** @brief Capacity of each wave buffer, in samples */
+    size_t preloaded; /** @brief Number of wave buffers that were decoded ahead of the start time */
+    u64 bufStart[3]; /** @brief Stream position of the first sample in each wave buffer */
+    u64 decodePos; /** @brief Stream position of the next sample to be decoded */
+
+    ndspWaveBuf leadBuf; /** @brief Wave buffer of silence played before the stream to line up its first sample */
+    size_t leadCapacity; /** @brief Capacity of the silence wave buffer, in samples */
+
+    u64 startClock; /** @brief Audio clock time at which the stream was requested to start */
+    u64 actualStartClock; /** @brief Audio clock time at which NDSP actually played the stream's first sample */
 
     LightEvent event; /** @brief Event for signaling audio thread */
     Thread thread; /** @brief Thread for audio playback */
@@ -53,6 +73,10 @@ typedef struct {
 static AudioStream streams[MAX_STREAMS];
 static int nextId = 1;
 
+static bool audioInitDone = false; /** @brief Whether audioInitSystem() has run since the last audioExitSystem() */
+static bool audioReady = false; /** @brief Whether NDSP initialized successfully, checked by every audio entry point */
+static Result audioInitResult = 0; /** @brief Result of the last ndspInit() call */
+
 
 /**
  * @fn static const char *vorbisStrError(int error)
@@ -95,10 +119,14 @@ static bool initStreamBuffers(AudioStream *s) {
     ndspChnSetRate(s->channel, vi->rate);
     ndspChnSetFormat(s->channel, vi->channels == 1 ? NDSP_FORMAT_MONO_PCM16 : NDSP_FORMAT_STEREO_PCM16);
 
-    const size_t samplesPerBuf = vi->rate * 120 / 1000; // 120ms buffer
+    s->channels = vi->channels;
+    s->rate = vi->rate;
+    s->samplesPerBuf = vi->rate * 120 / 1000; // 120ms buffer
+    s->leadCapacity = (size_t)(NDSP_FRAME_SAMPLES * vi->rate / NDSP_SAMPLE_RATE) + 1; // Up to one NDSP frame of silence
     const size_t channelsPerSample = vi->channels;
-    const size_t waveBufSize = samplesPerBuf * channelsPerSample * sizeof(s16);
-    const size_t bufferSize = waveBufSize * ARRAY_SIZE(s->waveBufs);
+    const size_t waveBufSize = s->samplesPerBuf * channelsPerSample * sizeof(s16);
+    const size_t leadBufSize = s->leadCapacity * channelsPerSample * sizeof(s16);
+    const size_t bufferSize = waveBufSize * ARRAY_SIZE(s->waveBufs) + leadBufSize;
 
     s->audioBuffer = (int16_t *)linearAlloc(bufferSize);
     if (!s->audioBuffer) return false;
@@ -107,27 +135,34 @@ static bool initStreamBuffers(AudioStream *s) {
     int16_t *buf = s->audioBuffer;
     for (size_t i = 0; i < ARRAY_SIZE(s->waveBufs); ++i) {
         s->waveBufs[i].data_vaddr = buf;
-        s->waveBufs[i].nsamples = waveBufSize / sizeof(buf[0]);
+        s->waveBufs[i].nsamples = s->samplesPerBuf;
         s->waveBufs[i].status = NDSP_WBUF_DONE;
         buf += waveBufSize / sizeof(buf[0]);
     }
 
+    memset(&s->leadBuf, 0, sizeof(s->leadBuf));
+    memset(buf, 0, leadBufSize);
+    DSP_FlushDataCache(buf, leadBufSize);
+    s->leadBuf.data_vaddr = buf;
+    s->leadBuf.status = NDSP_WBUF_DONE;
+
     return true;
 }
 
 /**
- * @fn static bool fillBuffer(AudioStream *s, ndspWaveBuf *waveBuf)
- * @brief Decodes audio samples from a Vorbis file and fills the provided NDSP wave buffer.
- * @since rev12 (v0.0.1a)
+ * @fn static bool decodeBuffer(AudioStream *s, ndspWaveBuf *waveBuf)
+ * @brief Decodes audio samples from a Vorbis file into the provided NDSP wave buffer, without queueing it.
+ * @since rev13 (v0.0.1a)
  * @param[in] s The AudioStream structure containing the Vorbis file and channel information.
  * @param[in] waveBuf The NDSP wave buffer to be filled with decoded audio samples.
  * @returns true if samples were successfully read and the buffer was filled, false if no samples were read.
  */
-static bool fillBuffer(AudioStream *s, ndspWaveBuf *waveBuf) {
+static bool decodeBuffer(AudioStream *s, ndspWaveBuf *waveBuf) {
+    const int bufferBytes = s->samplesPerBuf * s->channels * sizeof(s16);
     int totalBytes = 0;
-    while (totalBytes < waveBuf->nsamples * sizeof(s16)) {
+    while (totalBytes < bufferBytes) {
         int16_t *buffer = waveBuf->data_pcm16 + (totalBytes / sizeof(s16));
-        const size_t bufferSize = (waveBuf->nsamples * sizeof(s16) - totalBytes);
+        const size_t bufferSize = (bufferBytes - totalBytes);
         int bytesRead = ov_read(&s->vorbisFile, (char *)buffer, bufferSize, NULL);
         if (bytesRead <= 0) {
             if (bytesRead == 0) break;
@@ -139,31 +174,143 @@ static bool fillBuffer(AudioStream *s, ndspWaveBuf *waveBuf) {
 
     if (totalBytes == 0) return false;
 
-    waveBuf->nsamples = totalBytes / sizeof(s16);
-    ndspChnWaveBufAdd(s->channel, waveBuf);
+    waveBuf->nsamples = totalBytes / (sizeof(s16) * s->channels);
+    s->bufStart[waveBuf - s->waveBufs] = s->decodePos;
+    s->decodePos += waveBuf->nsamples;
     DSP_FlushDataCache(waveBuf->data_pcm16, totalBytes);
     return true;
 }
 
+/**
+ * @fn static bool fillBuffer(AudioStream *s, ndspWaveBuf *waveBuf)
+ * @brief Decodes audio samples from a Vorbis file and fills the provided NDSP wave buffer.
+ * @since rev12 (v0.0.1a)
+ * @param[in] s The AudioStream structure containing the Vorbis file and channel information.
+ * @param[in] waveBuf The NDSP wave buffer to be filled with decoded audio samples.
+ * @returns true if samples were successfully read and the buffer was filled, false if no samples were read.
+ */
+static bool fillBuffer(AudioStream *s, ndspWaveBuf *waveBuf) {
+    if (!decodeBuffer(s, waveBuf)) return false;
+    ndspChnWaveBufAdd(s->channel, waveBuf);
+    if (waveBuf == &s->waveBufs[0]) s->firstQueued = true;
+    return true;
+}
+
+/**
+ * @fn static void preloadBuffers(AudioStream *s)
+ * @brief Decodes the first wave buffers of the stream ahead of its start time.
+ * @since rev13 (v0.0.1a)
+ * @param[in] s The AudioStream to preload.
+ * @details Buffers that couldn't be filled (because the file is shorter than all of them) are left free, so the audio thread never touches them.
+ */
+static void preloadBuffers(AudioStream *s) {
+    s->preloaded = 0;
+    for (size_t i = 0; i < ARRAY_SIZE(s->waveBufs); ++i) s->waveBufs[i].status = NDSP_WBUF_FREE;
+
+    while (s->preloaded < ARRAY_SIZE(s->waveBufs)) {
+        if (!decodeBuffer(s, &s->waveBufs[s->preloaded])) {
+            if (s->loop && s->preloaded > 0) {
+                ov_raw_seek(&s->vorbisFile, 0);
+                s->decodePos = 0;
+                continue;
+            }
+            break;
+        }
+        s->preloaded++;
+    }
+}
+
+/**
+ * @fn static void startStream(AudioStream *s, u64 nextFrameClock)
+ * @brief Hands a scheduled stream's preloaded buffers to NDSP so its first sample lands on its start time.
+ * @since rev13 (v0.0.1a)
+ * @param[in] s The AudioStream to start.
+ * @param nextFrameClock The audio clock time at which the next NDSP frame starts.
+ * @details The start time is reached partway through the next frame, so a short buffer of silence is queued first to cover the gap.
+ * @note Called from the NDSP frame callback.
+ */
+static void startStream(AudioStream *s, u64 nextFrameClock) {
+    u64 lead = (s->startClock > nextFrameClock) ? s->startClock - nextFrameClock : 0;
+    size_t leadSamples = (size_t)(lead * s->rate / NDSP_SAMPLE_RATE);
+    if (leadSamples > s->leadCapacity) leadSamples = s->leadCapacity;
+
+    if (leadSamples > 0) {
+        s->leadBuf.nsamples = leadSamples;
+        ndspChnWaveBufAdd(s->channel, &s->leadBuf);
+    }
+    for (size_t i = 0; i < s->preloaded; ++i) {
+        ndspChnWaveBufAdd(s->channel, &s->waveBufs[i]);
+    }
+    s->firstQueued = true;
+
+    s->scheduled = false;
+    s->started = true;
+}
+
+/**
+ * @fn static void observeStart(AudioStream *s, u64 frameClock)
+ * @brief Records when NDSP actually played the stream's first sample, once it reports the first wave buffer playing.
+ * @since rev13 (v0.0.1a)
+ * @param[in] s The AudioStream to check.
+ * @param frameClock The audio clock time at the end of the frame NDSP just processed.
+ * @details The first sample played however far back from the end of the frame the channel's sample position says.
+ * @note Called from the NDSP frame callback.
+ * @note Nothing is recorded until the first wave buffer has been queued, since its status is DONE from initStreamBuffers() before that.
+ */
+static void observeStart(AudioStream *s, u64 frameClock) {
+    ndspWaveBuf *first = &s->waveBufs[0];
+    if (!s->firstQueued) return;
+    if (first->status != NDSP_WBUF_PLAYING && first->status != NDSP_WBUF_DONE) return;
+
+    u32 played = first->nsamples; // Already finished, so every sample in it has played
+    if (first->status == NDSP_WBUF_PLAYING && ndspChnGetWaveBufSeq(s->channel) == first->sequence_id) {
+        played = ndspChnGetSamplePos(s->channel);
+    }
+
+    u64 playedClock = (u64)(played * NDSP_SAMPLE_RATE / s->rate);
+    s->actualStartClock = (frameClock > playedClock) ? frameClock - playedClock : 0;
+    s->startObserved = true;
+}
+
+/**
+ * @fn static bool buffersPending(AudioStream *s)
+ * @brief Checks if any of the stream's wave buffers are still waiting to be played or playing.
+ * @since rev13 (v0.0.1a)
+ * @param[in] s The AudioStream to check.
+ * @returns true if NDSP still has audio to play for the stream, false otherwise.
+ */
+static bool buffersPending(AudioStream *s) {
+    if (!s->started) return true; // Preloaded buffers haven't been handed to NDSP yet
+    if (s->leadBuf.status == NDSP_WBUF_QUEUED || s->leadBuf.status == NDSP_WBUF_PLAYING) return true;
+    for (size_t i = 0; i < ARRAY_SIZE(s->waveBufs); ++i) {
+        if (s->waveBufs[i].status == NDSP_WBUF_QUEUED || s->waveBufs[i].status == NDSP_WBUF_PLAYING) return true;
+    }
+    return false;
+}
+
 /**
  * @fn static void audioThread(void *arg)
  * @brief Thread function for playing back audio.
  * @since rev12 (v0.0.1a)
  * @param[in] arg Pointer to the AudioStream structure containing the audio data and channel information.
+ * @details Once a non-looping file has been fully decoded, the stream stays active until NDSP has played its last queued buffers, so its position can still be queried and its channel isn't reused mid-tail.
  */
 static void audioThread(void *arg) {
     AudioStream *s = (AudioStream *)arg;
 
     while (!s->quit) {
-        for (size_t i = 0; i < ARRAY_SIZE(s->waveBufs); ++i) {
+        if (s->decodeDone && !buffersPending(s)) break;
+
+        for (size_t i = 0; i < ARRAY_SIZE(s->waveBufs) && !s->decodeDone; ++i) {
             if (s->waveBufs[i].status != NDSP_WBUF_DONE) continue;
             if (!fillBuffer(s, &s->waveBufs[i])) {
                 if (s->loop) {
                     ov_raw_seek(&s->vorbisFile, 0);
+                    s->decodePos = 0;
                     i--;
                     continue;
                 }
-                s->quit = true;
+                s->decodeDone = true;
                 break;
             }
         }
@@ -176,41 +323,108 @@ static void audioThread(void *arg) {
  * @fn static void ndspCallback(void *unused)
  * @brief NDSP audio frame callback
  * @since rev12 (v0.0.1a)
- * @details This signals the audio thread to fill the wave buffer again once NDSP has played a sound frame, meaning that there should be one or more available waveBufs to fill with more data.
+ * @details This records when newly started streams actually began playing, and starts any scheduled streams whose start time falls within the next frame. It then signals the audio thread to fill the wave buffer again once NDSP has played a sound frame, meaning that there should be one or more available waveBufs to fill with more data.
  */
 static void audioNdspCallback(void *unused) {
     (void)unused;
+
+    u64 nextFrameClock = (u64)ndspGetFrameCount() * NDSP_FRAME_SAMPLES; // Same as audioClock(), without waiting for init from the NDSP thread
+
     for (int i = 0; i < MAX_STREAMS; i++) {
-        if (streams[i].active && !streams[i].quit) {
-            LightEvent_Signal(&streams[i].event);
-        }
+        AudioStream *s = &streams[i];
+        if (!s->active || s->quit) continue;
+        if (s->started && !s->startObserved) observeStart(s, nextFrameClock);
+        if (s->scheduled && s->startClock < nextFrameClock + NDSP_FRAME_SAMPLES) startStream(s, nextFrameClock);
+        if (s->started) LightEvent_Signal(&s->event);
     }
 }   
 
+/**
+ * @fn static AudioStream *findStream(int id)
+ * @brief Finds an active audio stream by ID.
+ * @since rev13 (v0.0.1a)
+ * @param id The audio ID of the stream.
+ * @returns Pointer to the AudioStream, or NULL if there is no active stream with that ID.
+ */
+static AudioStream *findStream(int id) {
+    if (!audioReady) return NULL;
+    for (int i = 0; i < MAX_STREAMS; i++) {
+        if (streams[i].active && streams[i].id == id) return &streams[i];
+    }
+    return NULL;
+}
+
 /**
  * @fn void audioInitSystem();
  * @brief Initializes the audio system.
  * @since rev12 (v0.0.1a)
  * @note This function must be called before any other audio functions.
+ * @note Calling it again does nothing until audioExitSystem() is called.
  */
 void audioInitSystem(void) {
+    if (audioInitDone) return;
+
     memset(streams, 0, sizeof(streams));
-    ndspInit();
+    audioInitResult = ndspInit();
+    if (R_FAILED(audioInitResult)) { // Not printed, this usually runs on the deferred init thread while the menu is showing
+        audioInitDone = true;
+        return;
+    }
+
     ndspSetOutputMode(NDSP_OUTPUT_STEREO);
     ndspSetCallback(audioNdspCallback, NULL);
+    audioReady = true; // Set last, the other audio functions check this before touching NDSP
+    audioInitDone = true;
 }
 
 /**
- * @fn int audioPlay(const char *path, bool loop);
- * @brief Plays an vorbis (OGG) audio file from the specified path.
- * @since rev12 (v0.0.1a)
+ * @fn bool audioIsReady(void);
+ * @brief Checks if the audio system initialized successfully.
+ * @since rev13 (v0.0.1a)
+ * @returns true if NDSP is up and the other audio functions can be used, false if the audio system hasn't been initialized or ndspInit() failed.
+ * @note ndspInit() commonly fails when there is no DSP firmware dump (sdmc:/3ds/dspfirm.cdc).
+ */
+bool audioIsReady(void) {
+    return audioReady;
+}
+
+/**
+ * @fn uint64_t audioClock(void);
+ * @brief Gets the current time of the audio clock.
+ * @since rev13 (v0.0.1a)
+ * @returns The number of output samples NDSP has processed since the audio system was initialized.
+ * @note The clock runs at NDSP_SAMPLE_RATE (about 32728 samples per second), counting from NDSP's frame count. It only moves forward, in steps of one NDSP frame (160 samples, about 4.9ms).
+ */
+uint64_t audioClock(void) {
+    if (!audioReady) return 0;
+    return (uint64_t)ndspGetFrameCount() * NDSP_FRAME_SAMPLES;
+}
+
+/**
+ * @fn uint64_t audioClockFromMs(uint32_t ms);
+ * @brief Converts a duration in milliseconds to audio clock samples.
+ * @since rev13 (v0.0.1a)
+ * @param ms The duration in milliseconds.
+ * @returns The duration in audio clock samples.
+ * @note Useful for scheduling, e.g. audioPlayAt(path, false, audioClock() + audioClockFromMs(500)).
+ */
+uint64_t audioClockFromMs(uint32_t ms) {
+    return (uint64_t)(ms * (NDSP_SAMPLE_RATE / 1000.0));
+}
+
+/**
+ * @fn static int openStream(const char *path, bool loop, u64 startClock, bool preload)
+ * @brief Opens a vorbis (OGG) audio file and starts its audio thread.
+ * @since rev13 (v0.0.1a)
  * @param path The path to the audio file to play.
  * @param loop Whether to loop the audio file.
+ * @param startClock The audio clock time at which the first sample of the file should play (only used when preloading).
+ * @param preload Whether to decode the first buffers on the calling thread and schedule the stream for startClock, or to start right away and let the audio thread decode as it goes.
  * @returns Audio ID if successful, or -1 if an error occurred.
- * @note This function can be called after initializing the audio system.
- * @note The 3DS uses romfs for audio files, so the path should be in the format "romfs:/path/to/audio.ogg".
  */
-int audioPlay(const char *path, bool loop) {
+static int openStream(const char *path, bool loop, u64 startClock, bool preload) {
+    if (!audioReady) return -1;
+
     int slot = -1;
     for (int i = 0; i < MAX_STREAMS; i++) {
         if (!streams[i].active) { slot = i; break; }
@@ -224,6 +438,7 @@ int audioPlay(const char *path, bool loop) {
     s->active = true;
     s->quit = false;
     s->channel = slot;
+    s->startClock = startClock;
 
     s->fileHandle = fopen(path, "rb");
     if (!s->fileHandle) { s->active = false; return -1; }
@@ -243,6 +458,15 @@ int audioPlay(const char *path, bool loop) {
         return -1;
     }
 
+    if (preload) preloadBuffers(s);
+    if (preload && s->preloaded == 0) {
+        linearFree(s->audioBuffer);
+        ov_clear(&s->vorbisFile);
+        fclose(s->fileHandle);
+        s->active = false;
+        return -1;
+    }
+
     LightEvent_Init(&s->event, RESET_ONESHOT);
 
     s32 priority;
@@ -258,9 +482,99 @@ int audioPlay(const char *path, bool loop) {
         return -1;
     }
 
+    // Set last, the NDSP callback picks the stream up from here
+    if (preload) s->scheduled = true;
+    else s->started = true;
     return s->id;
 }
 
+/**
+ * @fn int audioPlay(const char *path, bool loop);
+ * @brief Plays an vorbis (OGG) audio file from the specified path.
+ * @since rev12 (v0.0.1a)
+ * @param path The path to the audio file to play.
+ * @param loop Whether to loop the audio file.
+ * @returns Audio ID if successful, or -1 if an error occurred.
+ * @note This function can be called after initializing the audio system.
+ * @note The 3DS uses romfs for audio files, so the path should be in the format "romfs:/path/to/audio.ogg".
+ */
+int audioPlay(const char *path, bool loop) {
+    return openStream(path, loop, 0, false);
+}
+
+/**
+ * @fn int audioPlayAt(const char *path, bool loop, uint64_t startClock);
+ * @brief Plays an vorbis (OGG) audio file from the specified path, starting at an exact audio clock time.
+ * @since rev13 (v0.0.1a)
+ * @param path The path to the audio file to play.
+ * @param loop Whether to loop the audio file.
+ * @param startClock The audio clock time at which the first sample of the file should play.
+ * @returns Audio ID if successful, or -1 if an error occurred.
+ * @details The first buffers are decoded before this function returns, so the stream starts on time no matter how long decoding takes. Streams scheduled for the same start time start on the same sample.
+ * @note If the start time has already passed, the stream starts on the next NDSP frame.
+ */
+int audioPlayAt(const char *path, bool loop, uint64_t startClock) {
+    return openStream(path, loop, startClock, true);
+}
+
+/**
+ * @fn int64_t audioGetPosition(int id);
+ * @brief Gets the current playback position of the specified audio stream.
+ * @since rev13 (v0.0.1a)
+ * @param id The audio ID of the stream.
+ * @returns The position in samples at the stream's own sample rate, or -1 if there is no active stream with that ID.
+ * @note Returns 0 while the stream is waiting for its start time. For looping streams the position goes back to 0 on each loop.
+ */
+int64_t audioGetPosition(int id) {
+    AudioStream *s = findStream(id);
+    if (!s) return -1;
+    if (!s->started) return 0;
+
+    u16 seq = ndspChnGetWaveBufSeq(s->channel);
+    if (seq != 0 && seq == s->leadBuf.sequence_id) return 0;
+
+    // Find the wave buffer that is playing, or failing that the next one queued to play
+    ndspWaveBuf *next = NULL;
+    for (size_t i = 0; i < ARRAY_SIZE(s->waveBufs); ++i) {
+        ndspWaveBuf *waveBuf = &s->waveBufs[i];
+        if (seq != 0 && waveBuf->sequence_id == seq && waveBuf->status == NDSP_WBUF_PLAYING) {
+            return s->bufStart[i] + ndspChnGetSamplePos(s->channel);
+        }
+        if (waveBuf->status == NDSP_WBUF_QUEUED && (!next || (s16)(waveBuf->sequence_id - next->sequence_id) < 0)) next = waveBuf;
+    }
+
+    if (s->leadBuf.status == NDSP_WBUF_QUEUED || s->leadBuf.status == NDSP_WBUF_PLAYING) return 0;
+    if (next) return s->bufStart[next - s->waveBufs];
+    return s->decodePos; // Everything decoded so far has been played
+}
+
+/**
+ * @fn int audioGetSampleRate(int id);
+ * @brief Gets the sample rate of the specified audio stream.
+ * @since rev13 (v0.0.1a)
+ * @param id The audio ID of the stream.
+ * @returns The sample rate in samples per second, or -1 if there is no active stream with that ID.
+ * @note Use this to convert the result of audioGetPosition() to seconds.
+ */
+int audioGetSampleRate(int id) {
+    AudioStream *s = findStream(id);
+    return s ? s->rate : -1;
+}
+
+/**
+ * @fn int64_t audioGetStartClock(int id);
+ * @brief Gets the audio clock time at which the specified stream actually started.
+ * @since rev13 (v0.0.1a)
+ * @param id The audio ID of the stream.
+ * @returns The audio clock time at which NDSP played the stream's first sample, or -1 if NDSP hasn't played it yet or there is no active stream with that ID.
+ * @note Comparing this against the requested start time gives the start jitter of audioPlayAt().
+ */
+int64_t audioGetStartClock(int id) {
+    AudioStream *s = findStream(id);
+    if (!s || !s->startObserved) return -1;
+    return s->actualStartClock;
+}
+
 /**
  * @fn void audioStop(int id);
  * @brief Stops the audio playback for the specified audio ID.
@@ -268,6 +582,7 @@ int audioPlay(const char *path, bool loop) {
  * @param id The audio ID of the playback to stop.
  */
 void audioStop(int id) {
+    if (!audioReady) return;
     for (int i = 0; i < MAX_STREAMS; i++) {
         AudioStream *s = &streams[i];
         if (s->active && s->id == id) {
@@ -295,6 +610,7 @@ void audioStop(int id) {
  * @note Reccommended to use this function when exiting the program.
  */
 void audioStopAll(void) {
+    if (!audioReady) return;
     for (int i = 0; i < MAX_STREAMS; i++) {
         if (streams[i].active) {
             audioStop(streams[i].id);
@@ -309,6 +625,10 @@ void audioStopAll(void) {
  * @note This function stops all currently playing audio, regardless of ID.
  */
 void audioExitSystem(void) {
-    audioStopAll();
-    ndspExit();
+    if (audioReady) {
+        audioStopAll();
+        ndspExit();
+    }
+    audioReady = false;
+    audioInitDone = false;
 }
\ No newline at end of file
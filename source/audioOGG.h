@@ -2,20 +2,33 @@
 #define headerAudioOGG
 
 #include <stdbool.h>
+#include <stdint.h>
 
 /**
  * @fn void audioInitSystem();
  * @brief Initializes the audio system.
  * @since rev12 (v0.0.1a)
  * @note This function must be called before any other audio functions.
+ * @note Calling it again does nothing until audioExitSystem() is called.
+ * @note If it is deferred with bootDeferAdd(), call bootDeferWait() before first use. Until it has succeeded, the other audio functions fail right away (returning -1, or 0 for audioClock()).
  */
 void audioInitSystem(void);
 
+/**
+ * @fn bool audioIsReady(void);
+ * @brief Checks if the audio system initialized successfully.
+ * @since rev13 (v0.0.1a)
+ * @returns true if NDSP is up and the other audio functions can be used, false if the audio system hasn't been initialized or ndspInit() failed.
+ * @note ndspInit() commonly fails when there is no DSP firmware dump (sdmc:/3ds/dspfirm.cdc).
+ */
+bool audioIsReady(void);
+
 /**
  * @fn void audioExitSystem();
  * @brief Exits the audio system.
  * @since rev12 (v0.0.1a)
  * @note This function must be called before the program exits.
+ * @note Safe to call even if the audio system was never initialized or failed to initialize.
  */
 void audioExitSystem(void);
 
@@ -31,6 +44,66 @@ void audioExitSystem(void);
  */
 int audioPlay(const char *path, bool loop);
 
+/**
+ * @fn int audioPlayAt(const char *path, bool loop, uint64_t startClock);
+ * @brief Plays an vorbis (OGG) audio file from the specified path, starting at an exact audio clock time.
+ * @since rev13 (v0.0.1a)
+ * @param path The path to the audio file to play.
+ * @param loop Whether to loop the audio file.
+ * @param startClock The audio clock time at which the first sample of the file should play.
+ * @returns Audio ID if successful, or -1 if an error occurred.
+ * @note Streams scheduled for the same start time start on the same sample, so this can be used to line up several stems.
+ * @note If the start time has already passed, the stream starts on the next NDSP frame.
+ */
+int audioPlayAt(const char *path, bool loop, uint64_t startClock);
+
+/**
+ * @fn uint64_t audioClock(void);
+ * @brief Gets the current time of the audio clock.
+ * @since rev13 (v0.0.1a)
+ * @returns The number of output samples NDSP has processed since the audio system was initialized.
+ * @note The clock runs at NDSP_SAMPLE_RATE (about 32728 samples per second), counting from NDSP's frame count. It only moves forward, in steps of one NDSP frame (160 samples, about 4.9ms).
+ */
+uint64_t audioClock(void);
+
+/**
+ * @fn uint64_t audioClockFromMs(uint32_t ms);
+ * @brief Converts a duration in milliseconds to audio clock samples.
+ * @since rev13 (v0.0.1a)
+ * @param ms The duration in milliseconds.
+ * @returns The duration in audio clock samples.
+ */
+uint64_t audioClockFromMs(uint32_t ms);
+
+/**
+ * @fn int64_t audioGetPosition(int id);
+ * @brief Gets the current playback position of the specified audio stream.
+ * @since rev13 (v0.0.1a)
+ * @param id The audio ID of the stream.
+ * @returns The position in samples at the stream's own sample rate, or -1 if there is no active stream with that ID.
+ * @note Returns 0 while the stream is waiting for its start time. For looping streams the position goes back to 0 on each loop.
+ */
+int64_t audioGetPosition(int id);
+
+/**
+ * @fn int audioGetSampleRate(int id);
+ * @brief Gets the sample rate of the specified audio stream.
+ * @since rev13 (v0.0.1a)
+ * @param id The audio ID of the stream.
+ * @returns The sample rate in samples per second, or -1 if there is no active stream with that ID.
+ */
+int audioGetSampleRate(int id);
+
+/**
+ * @fn int64_t audioGetStartClock(int id);
+ * @brief Gets the audio clock time at which the specified stream actually started.
+ * @since rev13 (v0.0.1a)
+ * @param id The audio ID of the stream.
+ * @returns The audio clock time at which NDSP played the stream's first sample, or -1 if NDSP hasn't played it yet or there is no active stream with that ID.
+ * @note Comparing this against the requested start time gives the start jitter of audioPlayAt().
+ */
+int64_t audioGetStartClock(int id);
+
 /**
  * @fn void audioStop(int id);
  * @brief Stops the audio playback for the specified audio ID.
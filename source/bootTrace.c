@@ -0,0 +1,285 @@
+// ███████████████████████████████████████████████
+// █▄─▄─▀█─▄▄─█▄─▄▄▀█▄─▄▄─█▄─▄▄▀█▄▄▄ █▄─▄▄▀█─▄▄▄▄█
+// ██─▄─▀█─██─██─▄─▄██─▄█▀██─██─██▄▄ ██─██─█▄▄▄▄─█
+// █▄▄▄▄██▄▄▄▄█▄▄█▄▄█▄▄▄▄▄█▄▄▄▄██▄▄▄▄█▄▄▄▄██▄▄▄▄▄█
+
+// Boot Trace & Deferred Initialization
+// Timestamps each startup step up to the first frame, and initializes non-critical subsystems in the background.
+
+//   ╔════════════════════════════════════════════════╗
+// ══╣                    INCLUDES                    ╠══
+//   ╚════════════════════════════════════════════════╝
+#include <3ds.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bootTrace.h"
+
+
+//   ╔════════════════════════════════════════════════╗
+// ══╣                  DEFINITIONS                   ╠══
+//   ╚════════════════════════════════════════════════╝
+#define MAX_TRACE_MARKS 24 /** @brief Maximum number of boot steps that can be recorded */
+#define MAX_DEFERRED 8 /** @brief Maximum number of subsystems that can be deferred */
+#define THREAD_STACK_SZ (16 * 1024) /** @brief Stack size for the deferred init thread */
+#define THREAD_AFFINITY -1 /** @brief Thread affinity for the deferred init thread */
+
+
+//   ╔════════════════════════════════════════════════╗
+// ══╣               BOOT TRACE STRUCTURES            ╠══
+//   ╚════════════════════════════════════════════════╝
+typedef struct {
+    const char *label; /** @brief Name of the boot step */
+    u64 startTick; /** @brief System tick at which the boot step started @note 0 means it started when the previous main thread step finished. */
+    u64 tick; /** @brief System tick at which the boot step finished */
+    bool deferred; /** @brief Whether the boot step ran on the deferred init thread */
+} TraceMark;
+
+typedef enum {
+    DEFER_PENDING, /** @brief The subsystem hasn't started initializing yet */
+    DEFER_RUNNING, /** @brief The subsystem is currently initializing */
+    DEFER_DONE /** @brief The subsystem has finished initializing */
+} DeferState;
+
+typedef struct {
+    const char *name; /** @brief Name of the subsystem */
+    bootDeferFunction init; /** @brief Function that initializes the subsystem */
+    DeferState state; /** @brief Current initialization state of the subsystem */
+    LightEvent done; /** @brief Event signaled once the subsystem has finished initializing */
+} DeferredInit;
+
+static u64 traceStart;
+static TraceMark traceMarks[MAX_TRACE_MARKS];
+static int traceCount = 0;
+static LightLock traceLock;
+
+static DeferredInit deferred[MAX_DEFERRED];
+static int deferredCount = 0;
+static LightLock deferLock;
+static Thread deferThread = NULL;
+
+
+//   ╔════════════════════════════════════════════════╗
+// ══╣                   FUNCTIONS                    ╠══
+//   ╚════════════════════════════════════════════════╝
+
+/**
+ * @fn static double ticksToMs(u64 ticks)
+ * @brief Converts a system tick count to milliseconds.
+ * @since rev13 (v0.0.1a)
+ * @param ticks The tick count to convert.
+ * @returns The tick count in milliseconds.
+ */
+static double ticksToMs(u64 ticks) {
+    return (double)ticks / CPU_TICKS_PER_MSEC;
+}
+
+/**
+ * @fn static void traceMarkAt(const char *label, u64 startTick, bool background)
+ * @brief Records a timestamp for the specified boot step.
+ * @since rev13 (v0.0.1a)
+ * @param label The name of the boot step that just finished.
+ * @param startTick The system tick at which the boot step started, or 0 if it started when the previous main thread step finished.
+ * @param background Whether the boot step ran on the deferred init thread.
+ */
+static void traceMarkAt(const char *label, u64 startTick, bool background) {
+    u64 now = svcGetSystemTick();
+
+    LightLock_Lock(&traceLock);
+    if (traceCount < MAX_TRACE_MARKS) {
+        traceMarks[traceCount].label = label;
+        traceMarks[traceCount].startTick = startTick;
+        traceMarks[traceCount].tick = now;
+        traceMarks[traceCount].deferred = background;
+        traceCount++;
+    }
+    LightLock_Unlock(&traceLock);
+}
+
+/**
+ * @fn static DeferredInit *findDeferred(const char *name)
+ * @brief Finds a registered subsystem by name.
+ * @since rev13 (v0.0.1a)
+ * @param name The name the subsystem was registered with.
+ * @returns Pointer to the subsystem entry, or NULL if it isn't registered.
+ */
+static DeferredInit *findDeferred(const char *name) {
+    for (int i = 0; i < deferredCount; i++) {
+        if (strcmp(deferred[i].name, name) == 0) return &deferred[i];
+    }
+    return NULL;
+}
+
+/**
+ * @fn static void runDeferred(DeferredInit *d, bool background)
+ * @brief Initializes the given subsystem if nobody else has claimed it, otherwise waits for it to finish.
+ * @since rev13 (v0.0.1a)
+ * @param[in] d The subsystem entry to initialize.
+ * @param background Whether this is being called from the deferred init thread.
+ */
+static void runDeferred(DeferredInit *d, bool background) {
+    LightLock_Lock(&deferLock);
+    bool claimed = d->state == DEFER_PENDING;
+    if (claimed) d->state = DEFER_RUNNING;
+    LightLock_Unlock(&deferLock);
+
+    if (!claimed) {
+        LightEvent_Wait(&d->done);
+        return;
+    }
+
+    u64 start = svcGetSystemTick();
+    d->init();
+    traceMarkAt(d->name, start, background);
+
+    LightLock_Lock(&deferLock);
+    d->state = DEFER_DONE;
+    LightLock_Unlock(&deferLock);
+    LightEvent_Signal(&d->done);
+}
+
+/**
+ * @fn static void deferThreadMain(void *arg)
+ * @brief Thread function that initializes every registered subsystem in order.
+ * @since rev13 (v0.0.1a)
+ * @param[in] arg Unused.
+ */
+static void deferThreadMain(void *arg) {
+    (void)arg;
+    for (int i = 0; i < deferredCount; i++) {
+        runDeferred(&deferred[i], true);
+    }
+}
+
+/**
+ * @fn void bootTraceInit(void);
+ * @brief Starts the boot trace clock.
+ * @since rev13 (v0.0.1a)
+ * @note This should be the very first thing called in main, every timestamp is relative to it.
+ */
+void bootTraceInit(void) {
+    LightLock_Init(&traceLock);
+    LightLock_Init(&deferLock);
+    traceCount = 0;
+    deferredCount = 0;
+    traceStart = svcGetSystemTick();
+}
+
+/**
+ * @fn void bootTraceMark(const char *label);
+ * @brief Records a timestamp for the specified boot step.
+ * @since rev13 (v0.0.1a)
+ * @param label The name of the boot step that just finished.
+ * @note The label is stored by pointer, so it should be a string literal.
+ */
+void bootTraceMark(const char *label) {
+    traceMarkAt(label, 0, false);
+}
+
+/**
+ * @fn void bootTracePrint(PrintConsole *console);
+ * @brief Prints the boot step breakdown to the specified console.
+ * @since rev13 (v0.0.1a)
+ * @param console The console to print the breakdown on (meant for the bottom screen).
+ * @details Each row shows the time the step took (deferred steps are timed from when their init started, other steps from the previous main thread step), and the time since boot. Deferred steps are marked with a "*".
+ */
+void bootTracePrint(PrintConsole *console) {
+    consoleSelect(console);
+    printf("\x1b[2J\x1b[H");
+    printf("BOOT TRACE            step ms  total ms\n");
+    printf("----------------------------------------");
+
+    LightLock_Lock(&traceLock);
+    u64 lastMain = traceStart;
+    for (int i = 0; i < traceCount; i++) {
+        TraceMark *m = &traceMarks[i];
+        u64 start = m->startTick ? m->startTick : lastMain;
+
+        printf("%c%-20.20s%8.2f %9.2f\n", m->deferred ? '*' : ' ', m->label, ticksToMs(m->tick - start), ticksToMs(m->tick - traceStart));
+        if (!m->deferred) lastMain = m->tick;
+    }
+    LightLock_Unlock(&traceLock);
+
+    printf("----------------------------------------");
+    printf("* = initialized in the background\n");
+}
+
+/**
+ * @fn bool bootDeferAdd(const char *name, bootDeferFunction init);
+ * @brief Registers a non-critical subsystem to be initialized after the first frame.
+ * @since rev13 (v0.0.1a)
+ * @param name The name of the subsystem, also used as its boot trace label.
+ * @param init The function that initializes the subsystem.
+ * @returns true if the subsystem was registered, false if there are no free slots.
+ * @note Subsystems are initialized in the order they were registered.
+ */
+bool bootDeferAdd(const char *name, bootDeferFunction init) {
+    if (deferThread != NULL || deferredCount >= MAX_DEFERRED) return false;
+
+    DeferredInit *d = &deferred[deferredCount];
+    d->name = name;
+    d->init = init;
+    d->state = DEFER_PENDING;
+    LightEvent_Init(&d->done, RESET_STICKY);
+    deferredCount++;
+    return true;
+}
+
+/**
+ * @fn void bootDeferStart(void);
+ * @brief Starts initializing the registered subsystems on a background thread.
+ * @since rev13 (v0.0.1a)
+ * @note If the thread can't be created, the subsystems are initialized on first use instead.
+ */
+void bootDeferStart(void) {
+    if (deferThread != NULL || deferredCount == 0) return;
+
+    s32 priority;
+    svcGetThreadPriority(&priority, CUR_THREAD_HANDLE);
+    priority = (priority < 0x3F) ? priority + 1 : 0x3F; // Lower than the main thread so the menu stays responsive
+
+    deferThread = threadCreate(deferThreadMain, NULL, THREAD_STACK_SZ, priority, THREAD_AFFINITY, false);
+}
+
+/**
+ * @fn void bootDeferWait(const char *name);
+ * @brief Makes sure the specified subsystem has finished initializing before returning.
+ * @since rev13 (v0.0.1a)
+ * @param name The name the subsystem was registered with.
+ * @note Call this before first use of a deferred subsystem, it initializes it right away if the background thread hasn't got to it yet.
+ */
+void bootDeferWait(const char *name) {
+    DeferredInit *d = findDeferred(name);
+    if (d) runDeferred(d, false);
+}
+
+/**
+ * @fn bool bootDeferReady(const char *name);
+ * @brief Checks if the specified subsystem has finished initializing, without waiting.
+ * @since rev13 (v0.0.1a)
+ * @param name The name the subsystem was registered with.
+ * @returns true if the subsystem is ready, false otherwise.
+ */
+bool bootDeferReady(const char *name) {
+    DeferredInit *d = findDeferred(name);
+    if (!d) return false;
+
+    LightLock_Lock(&deferLock);
+    bool ready = d->state == DEFER_DONE;
+    LightLock_Unlock(&deferLock);
+    return ready;
+}
+
+/**
+ * @fn void bootDeferExit(void);
+ * @brief Waits for the background init thread to finish and frees it.
+ * @since rev13 (v0.0.1a)
+ * @note This function must be called before exiting any deferred subsystem.
+ */
+void bootDeferExit(void) {
+    if (deferThread == NULL) return;
+
+    threadJoin(deferThread, UINT64_MAX);
+    threadFree(deferThread);
+    deferThread = NULL;
+}
@@ -0,0 +1,84 @@
+#ifndef headerBootTrace
+#define headerBootTrace
+
+#include <3ds.h>
+#include <stdbool.h>
+
+/**
+ * @fn typedef void (*bootDeferFunction)(void);
+ * @brief Function signature for a subsystem initializer that can be deferred.
+ * @since rev13 (v0.0.1a)
+ */
+typedef void (*bootDeferFunction)(void);
+
+/**
+ * @fn void bootTraceInit(void);
+ * @brief Starts the boot trace clock.
+ * @since rev13 (v0.0.1a)
+ * @note This should be the very first thing called in main, every timestamp is relative to it.
+ */
+void bootTraceInit(void);
+
+/**
+ * @fn void bootTraceMark(const char *label);
+ * @brief Records a timestamp for the specified boot step.
+ * @since rev13 (v0.0.1a)
+ * @param label The name of the boot step that just finished.
+ * @note The label is stored by pointer, so it should be a string literal.
+ */
+void bootTraceMark(const char *label);
+
+/**
+ * @fn void bootTracePrint(PrintConsole *console);
+ * @brief Prints the boot step breakdown to the specified console.
+ * @since rev13 (v0.0.1a)
+ * @param console The console to print the breakdown on (meant for the bottom screen).
+ */
+void bootTracePrint(PrintConsole *console);
+
+/**
+ * @fn bool bootDeferAdd(const char *name, bootDeferFunction init);
+ * @brief Registers a non-critical subsystem to be initialized after the first frame.
+ * @since rev13 (v0.0.1a)
+ * @param name The name of the subsystem, also used as its boot trace label.
+ * @param init The function that initializes the subsystem.
+ * @returns true if the subsystem was registered, false if there are no free slots.
+ * @note Subsystems are initialized in the order they were registered.
+ */
+bool bootDeferAdd(const char *name, bootDeferFunction init);
+
+/**
+ * @fn void bootDeferStart(void);
+ * @brief Starts initializing the registered subsystems on a background thread.
+ * @since rev13 (v0.0.1a)
+ * @note If the thread can't be created, the subsystems are initialized on first use instead.
+ */
+void bootDeferStart(void);
+
+/**
+ * @fn void bootDeferWait(const char *name);
+ * @brief Makes sure the specified subsystem has finished initializing before returning.
+ * @since rev13 (v0.0.1a)
+ * @param name The name the subsystem was registered with.
+ * @note Call this before first use of a deferred subsystem, it initializes it right away if the background thread hasn't got to it yet.
+ */
+void bootDeferWait(const char *name);
+
+/**
+ * @fn bool bootDeferReady(const char *name);
+ * @brief Checks if the specified subsystem has finished initializing, without waiting.
+ * @since rev13 (v0.0.1a)
+ * @param name The name the subsystem was registered with.
+ * @returns true if the subsystem is ready, false otherwise.
+ */
+bool bootDeferReady(const char *name);
+
+/**
+ * @fn void bootDeferExit(void);
+ * @brief Waits for the background init thread to finish and frees it.
+ * @since rev13 (v0.0.1a)
+ * @note This function must be called before exiting any deferred subsystem.
+ */
+void bootDeferExit(void);
+
+#endif // headerBootTrace
@@ -15,13 +15,16 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "audioOGG.h"
+#include "bootTrace.h"
+
 
 //   ╔════════════════════════════════════════════════╗
 // ══╣              VERSION INFORMATION               ╠══
 //   ╚════════════════════════════════════════════════╝
 const char *versionString = "v0.0.1a"; /** @brief Semantic version of the program @note Format: v{major}.{minor}.{patch}{alpha/beta} */
 const char *versionDate = "2025-08-01"; /** @brief Date of the last version of the program @note Format: YYYY-MM-DD */
-const int versionRev = 12; /** @brief Revision of the program, used for tracking changes in the codebase */
+const int versionRev = 13; /** @brief Revision of the program, used for tracking changes in the codebase */
 char versionText[32]; /** @brief Full semantic version/revision version text for display purposes */
 
 
@@ -56,6 +59,9 @@ int nextPhase; /** @brief Next phase of the application @note Phases are what I
 bool loadingScreenActive; /** @brief Whether the loading screen is active */
 bool loadingScreenShown; /** @brief Whether the loading screen has been printed */
 
+// Boot Tracking
+bool firstFramePresented; /** @brief Whether the first frame has been presented @note Deferred subsystems start initializing after this. */
+
 //   ╔════════════════════════════════════════════════╗
 // ══╣                   FUNCTIONS                    ╠══
 //   ╚════════════════════════════════════════════════╝
@@ -185,18 +191,29 @@ typedef void (*functionPointer)();
 //   ╚════════════════════════════════════════════════╝
 int main(int argc, char **argv)
 {
+    // Start the boot trace clock
+    bootTraceInit();
+
     // Set the version text
     sprintf(versionText, "%s (rev%d)", versionString, versionRev);
 
     // Start da graphix engines
     gfxInitDefault();
+    bootTraceMark("gfxInitDefault");
 
     // Start the romfs filesystem
     romfsInit();
+    bootTraceMark("romfsInit");
 
     // Use the PrintConsoles for the graphics
     consoleInit(GFX_TOP, &topScreen);
+    bootTraceMark("consoleInit (top)");
     consoleInit(GFX_BOTTOM, &bottomScreen);
+    bootTraceMark("consoleInit (bottom)");
+
+    // Non-critical subsystems get initialized in the background once the menu is showing
+    // Use bootDeferWait() before first use of any of these
+    bootDeferAdd("audioInitSystem", audioInitSystem);
 
     // Initialize the selection variables
     menuSelection = 1;
@@ -211,6 +228,7 @@ int main(int argc, char **argv)
     nextPhase = 1;
     loadingScreenActive = false;
     loadingScreenShown = false;
+    firstFramePresented = false;
 
     // Print options
     void mainMenu()
@@ -225,6 +243,7 @@ int main(int argc, char **argv)
     }
 
     mainMenu();
+    bootTraceMark("mainMenu");
     
     while (aptMainLoop())
     {
@@ -270,11 +289,13 @@ int main(int argc, char **argv)
                 };
 
                 menuNavigation();
+
+                if (kPress & KEY_SELECT) bootTracePrint(&bottomScreen); // If SELECT is pressed, show the boot trace on the bottom screen
             };
 
             if (menuSelectionChosen && !menuSelectionShown)
             {
-                clearScreen("top");
+                clearScreen("both"); // Also clears the boot trace off the bottom screen
                 menuOptionsVisible = false;
 
                 consoleSelect(&topScreen);
@@ -290,7 +311,9 @@ int main(int argc, char **argv)
                     printBanner("HOW TO PLAY", 1, 50);
                     printCenter("Use the D-Pad to navigate the menu", 3, 50);
                     printCenter("Press A to select an option.", 4, 50);
-                    printCenter("Have fun and enjoy the game!", 6, 50);
+                    printCenter("Press SELECT on the main menu", 5, 50);
+                    printCenter("to view the boot trace.", 6, 50);
+                    printCenter("Have fun and enjoy the game!", 8, 50);
 
                     consoleSelect(&bottomScreen);
                     printCenter("You'll get the hang of it!", 15, 40);
@@ -320,9 +343,18 @@ int main(int argc, char **argv)
         gfxFlushBuffers();
         gfxSwapBuffers();
         gspWaitForVBlank();
+
+        if (!firstFramePresented)
+        {
+            bootTraceMark("first frame");
+            bootDeferStart();
+            firstFramePresented = true;
+        }
     }
 
     // Clean up
+    bootDeferExit();
+    audioExitSystem();
     gfxExit();
 
     return 0;